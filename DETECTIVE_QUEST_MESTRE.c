@@ -2,56 +2,238 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <stdarg.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
 
-#define TAMANHO_HASH 26  // Uma posição para cada letra do alfabeto
+#define TAMANHO_HASH 26  // Tamanho inicial da tabela (uma posição por letra do alfabeto)
+#define TAMANHO_NOME 50     // Campos nome/suspeito
+#define TAMANHO_PISTA 100   // Campos pista/descricao
+#define TAMANHO_CHAVE 200  // Chave de ordenação: texto normalizado + separador + texto original
+#define TAMANHO_INDICE_SUSPEITOS 64  // Posições do índice suspeito → pistas
+#define LINHAS_POR_PAGINA 20  // Linhas exibidas por página nas visões 'p' e 'a'
+#define PESO_NORMAL 256       // Peso 1,0 em ponto fixo (8 bits fracionários)
+#define ESCALA_DECAIMENTO 65536  // Fator 1,0 do decaimento em ponto fixo (16 bits fracionários)
+#define MEIA_VIDA_PADRAO 6    // Movimentos até uma evidência valer metade
+#define TAMANHO_BENCHMARK 20000  // Quantidade padrão de pistas no modo --bench
+#define TAMANHO_REPLAY 200000    // Quantidade padrão de salas no modo --replay
 
 // Estrutura para representar uma sala (nó da árvore binária do mapa)
 typedef struct Sala {
-    char nome[50];
-    char pista[100];  // Pista encontrada nesta sala (vazia se não tiver pista)
+    char nome[TAMANHO_NOME];
+    char pista[TAMANHO_PISTA];  // Pista encontrada nesta sala (vazia se não tiver pista)
+    int peso;                   // Relevância de evidências achadas aqui (PESO_NORMAL = 1,0)
     struct Sala *esquerda;
     struct Sala *direita;
 } Sala;
 
+// Modos de ordenação (colação) do caderno de pistas
+typedef enum {
+    COLACAO_BINARIA,    // Bytes UTF-8 na ordem de strcmp
+    COLACAO_PORTUGUES   // Ignora maiúsculas e acentos ("Escritório" ao lado de "escritorio")
+} ModoColacao;
+
 // Estrutura para a árvore de busca de pistas
 typedef struct Pista {
-    char descricao[100];
+    char descricao[TAMANHO_PISTA];
+    unsigned char chave[TAMANHO_CHAVE];  // Chave de ordenação calculada uma vez na inserção
+    int tamanhoChave;
+    int tamanho;                         // Número de pistas na subárvore (para paginar sem percorrer tudo)
+    int vista;                           // 1 depois que a pista foi exibida ao jogador
     struct Pista *esquerda;
     struct Pista *direita;
 } Pista;
 
 // Estrutura para a tabela hash (associação pista → suspeito)
 typedef struct EntradaHash {
-    char pista[100];
-    char suspeito[50];
+    char pista[TAMANHO_PISTA];
+    char suspeito[TAMANHO_NOME];
+    int coletada;                           // 1 se a pista já foi encontrada na exploração
+    int peso;                               // Relevância da pista (PESO_NORMAL = 1,0)
+    struct FichaSuspeito *ficha;            // Suspeito no índice reverso
+    struct EntradaHash *proximoDoSuspeito;  // Próxima pista do mesmo suspeito
     struct EntradaHash *proximo;  // Para encadeamento em caso de colisão
 } EntradaHash;
 
-// Estrutura para contar suspeitos
-typedef struct ContadorSuspeito {
-    char nome[50];
-    int contagem;
-    struct ContadorSuspeito *proximo;
-} ContadorSuspeito;
+// Estrutura para o índice reverso (suspeito → lista de pistas)
+typedef struct FichaSuspeito {
+    char nome[TAMANHO_NOME];
+    EntradaHash *pistas;      // Lista ligada por EntradaHash.proximoDoSuspeito
+    int totalPistas;
+    int pistasColetadas;
+    int ordemPrimeiraColeta;  // Ordem em que o suspeito recebeu a primeira pista coletada (desempate)
+    long long pontuacao;      // Pontuação ponderada (escala PESO_NORMAL²), válida em movimentoPontuacao
+    int movimentoPontuacao;
+    struct FichaSuspeito *proximo;  // Para encadeamento em caso de colisão
+} FichaSuspeito;
+
+// Estrutura para uma visão (caderno ou associações) já formatada em memória.
+// Só é refeita quando a versão dos dados muda; exibir uma página apenas copia linhas.
+typedef struct VisaoRenderizada {
+    char *texto;
+    size_t tamanho;
+    size_t capacidade;
+    size_t *inicioLinha;     // Deslocamento de cada linha dentro de texto
+    int totalLinhas;
+    int capacidadeLinhas;
+    unsigned long versao;    // Versão dos dados usada na última renderização
+    int valida;
+    int primeiraLinha;       // Trecho renderizado (o caderno guarda só a página pedida)
+    int quantidadeLinhas;
+} VisaoRenderizada;
+
+// Modo de ordenação do caderno (definir antes de inserir a primeira pista)
+ModoColacao modoColacao = COLACAO_PORTUGUES;
+
+// Tabela Hash global (o número de posições cresce na carga em lote)
+EntradaHash** tabelaHash = NULL;
+int tamanhoHash = 0;
+int totalEntradasHash = 0;
+FichaSuspeito* indiceSuspeitos[TAMANHO_INDICE_SUSPEITOS];
+FichaSuspeito* fichaMaisCitada = NULL;  // Suspeito com mais pistas coletadas
+int suspeitosComColeta = 0;             // Próximo valor de ordemPrimeiraColeta
+
+// Versões dos dados exibidos: mudam a cada nova coleta ou nova associação
+unsigned long versaoCaderno = 0;
+unsigned long versaoAssociacoes = 0;
+VisaoRenderizada visaoCaderno;
+VisaoRenderizada visaoAssociacoes;
+
+// Contagem de movimentos e tabela de decaimento da pontuação (fator por movimentos decorridos)
+int movimentosExploracao = 0;
+int meiaVidaDecaimento = 0;
+unsigned int* fatorDecaimento = NULL;
+int limiteDecaimento = 0;
 
-// Tabela Hash global
-EntradaHash* tabelaHash[TAMANHO_HASH];
-ContadorSuspeito* listaSuspeitos = NULL;
+// Registro das pistas na ordem em que foram coletadas (para a visão de novidades)
+Pista** registroColetas = NULL;
+int totalColetas = 0;
+int capacidadeColetas = 0;
+int coletasVistas = 0;
 
-// Função hash simples baseada na primeira letra da pista
+// Função auxiliar para copiar texto truncando na capacidade do campo
+void copiarTexto(char* destino, const char* origem, size_t capacidade) {
+    size_t tamanho = strlen(origem);
+    if (tamanho >= capacidade) {
+        tamanho = capacidade - 1;
+    }
+    memcpy(destino, origem, tamanho);
+    destino[tamanho] = '\0';
+}
+
+// Função de espalhamento (FNV-1a) sobre o texto inteiro, sem diferenciar maiúsculas
+unsigned int espalharTexto(const char* texto) {
+    unsigned int hash = 2166136261u;
+    for (const unsigned char* c = (const unsigned char*)texto; *c != '\0'; c++) {
+        hash ^= (unsigned int)tolower(*c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Função hash da tabela de associações
 int funcaoHash(const char* pista) {
     if (pista == NULL || strlen(pista) == 0) {
         return 0;
     }
-    char primeiraLetra = tolower(pista[0]);
-    return (primeiraLetra - 'a') % TAMANHO_HASH;
+    return (int)(espalharTexto(pista) % (unsigned int)tamanhoHash);
 }
 
-// Função para inicializar a tabela hash
+// Função para inicializar a tabela hash (e o índice reverso por suspeito)
 void inicializarTabelaHash() {
-    for (int i = 0; i < TAMANHO_HASH; i++) {
-        tabelaHash[i] = NULL;
+    tabelaHash = (EntradaHash**)calloc(TAMANHO_HASH, sizeof(EntradaHash*));
+    if (tabelaHash == NULL) {
+        printf("Erro de alocação de memória!\n");
+        exit(1);
+    }
+    tamanhoHash = TAMANHO_HASH;
+    totalEntradasHash = 0;
+    for (int i = 0; i < TAMANHO_INDICE_SUSPEITOS; i++) {
+        indiceSuspeitos[i] = NULL;
+    }
+    fichaMaisCitada = NULL;
+    suspeitosComColeta = 0;
+}
+
+// Função para localizar a ficha de um suspeito no índice reverso.
+// Com criar = 1, uma ficha vazia é criada se o suspeito ainda não existir.
+FichaSuspeito* obterFichaSuspeito(const char* nome, int criar) {
+    char chave[TAMANHO_NOME];
+    copiarTexto(chave, nome, TAMANHO_NOME);
+    
+    int indice = (int)(espalharTexto(chave) % TAMANHO_INDICE_SUSPEITOS);
+    FichaSuspeito* atual = indiceSuspeitos[indice];
+    
+    while (atual != NULL) {
+        if (strcmp(atual->nome, chave) == 0) {
+            return atual;
+        }
+        atual = atual->proximo;
+    }
+    
+    if (!criar) {
+        return NULL;
+    }
+    
+    FichaSuspeito* nova = (FichaSuspeito*)malloc(sizeof(FichaSuspeito));
+    if (nova == NULL) {
+        printf("Erro de alocação de memória!\n");
+        exit(1);
+    }
+    strcpy(nova->nome, chave);
+    nova->pistas = NULL;
+    nova->totalPistas = 0;
+    nova->pistasColetadas = 0;
+    nova->ordemPrimeiraColeta = 0;
+    nova->pontuacao = 0;
+    nova->movimentoPontuacao = movimentosExploracao;
+    nova->proximo = indiceSuspeitos[indice];
+    indiceSuspeitos[indice] = nova;
+    return nova;
+}
+
+// Função para registrar uma entrada recém-criada no índice reverso
+void indexarEntradaPorSuspeito(EntradaHash* entrada) {
+    FichaSuspeito* ficha = obterFichaSuspeito(entrada->suspeito, 1);
+    entrada->coletada = 0;
+    entrada->ficha = ficha;
+    entrada->proximoDoSuspeito = ficha->pistas;
+    ficha->pistas = entrada;
+    ficha->totalPistas++;
+}
+
+// Função para redistribuir as entradas em uma tabela com mais posições
+void redimensionarTabelaHash(int novoTamanho) {
+    EntradaHash** antiga = tabelaHash;
+    int tamanhoAntigo = tamanhoHash;
+    
+    tabelaHash = (EntradaHash**)calloc(novoTamanho, sizeof(EntradaHash*));
+    if (tabelaHash == NULL) {
+        printf("Erro de alocação de memória!\n");
+        exit(1);
+    }
+    tamanhoHash = novoTamanho;
+    
+    // Percorre as listas de trás para frente para preservar a ordem relativa
+    for (int i = 0; i < tamanhoAntigo; i++) {
+        EntradaHash* atual = antiga[i];
+        EntradaHash* invertida = NULL;
+        while (atual != NULL) {
+            EntradaHash* proximo = atual->proximo;
+            atual->proximo = invertida;
+            invertida = atual;
+            atual = proximo;
+        }
+        while (invertida != NULL) {
+            EntradaHash* proximo = invertida->proximo;
+            int indice = funcaoHash(invertida->pista);
+            invertida->proximo = tabelaHash[indice];
+            tabelaHash[indice] = invertida;
+            invertida = proximo;
+        }
     }
+    free(antiga);
 }
 
 // Função para inserir associação pista → suspeito na tabela hash
@@ -60,6 +242,11 @@ void inserirNaHash(const char* pista, const char* suspeito) {
         return;
     }
     
+    // Dobrar a tabela quando o fator de carga passaria de 1 entrada por posição
+    if (totalEntradasHash + 1 > tamanhoHash) {
+        redimensionarTabelaHash(2 * tamanhoHash);
+    }
+    
     int indice = funcaoHash(pista);
     
     // Criar nova entrada
@@ -68,9 +255,11 @@ void inserirNaHash(const char* pista, const char* suspeito) {
         printf("Erro de alocação de memória!\n");
         exit(1);
     }
-    strcpy(novaEntrada->pista, pista);
-    strcpy(novaEntrada->suspeito, suspeito);
+    copiarTexto(novaEntrada->pista, pista, sizeof(novaEntrada->pista));
+    copiarTexto(novaEntrada->suspeito, suspeito, sizeof(novaEntrada->suspeito));
+    novaEntrada->peso = PESO_NORMAL;
     novaEntrada->proximo = NULL;
+    indexarEntradaPorSuspeito(novaEntrada);
     
     // Inserir na tabela hash (encadeamento para colisões)
     if (tabelaHash[indice] == NULL) {
@@ -80,14 +269,63 @@ void inserirNaHash(const char* pista, const char* suspeito) {
         novaEntrada->proximo = tabelaHash[indice];
         tabelaHash[indice] = novaEntrada;
     }
+    totalEntradasHash++;
+    versaoAssociacoes++;
+    versaoCaderno++;  // O caderno mostra o suspeito de cada pista
     
     printf("✅ Associação registrada: \"%s\" → %s\n", pista, suspeito);
 }
 
-// Função para buscar suspeito associado a uma pista
-char* buscarSuspeito(const char* pista) {
+// Função para carregar várias associações de uma vez (ex.: importação de arquivo).
+// A tabela é dimensionada antes pela quantidade conhecida, as entradas vêm de um
+// único bloco de memória e nenhuma confirmação é impressa por associação.
+void carregarAssociacoesEmLote(const char* pistas[], const char* suspeitos[], int quantidade) {
+    if (quantidade <= 0) {
+        return;
+    }
+    
+    // Fator de carga máximo de 1 entrada por posição
+    if (totalEntradasHash + quantidade > tamanhoHash) {
+        redimensionarTabelaHash(totalEntradasHash + quantidade);
+    }
+    
+    EntradaHash* bloco = (EntradaHash*)malloc(quantidade * sizeof(EntradaHash));
+    if (bloco == NULL) {
+        printf("Erro de alocação de memória!\n");
+        exit(1);
+    }
+    
+    int usadas = 0;
+    for (int i = 0; i < quantidade; i++) {
+        if (pistas[i] == NULL || strlen(pistas[i]) == 0) {
+            continue;
+        }
+        EntradaHash* novaEntrada = &bloco[usadas++];
+        copiarTexto(novaEntrada->pista, pistas[i], sizeof(novaEntrada->pista));
+        copiarTexto(novaEntrada->suspeito, suspeitos[i], sizeof(novaEntrada->suspeito));
+        novaEntrada->peso = PESO_NORMAL;
+        indexarEntradaPorSuspeito(novaEntrada);
+        
+        // Mesma política de inserirNaHash: a associação mais recente fica no início
+        int indice = funcaoHash(novaEntrada->pista);
+        novaEntrada->proximo = tabelaHash[indice];
+        tabelaHash[indice] = novaEntrada;
+    }
+    
+    // Nenhuma pista válida: nada foi inserido e as visões continuam atuais
+    if (usadas == 0) {
+        free(bloco);
+        return;
+    }
+    totalEntradasHash += usadas;
+    versaoAssociacoes++;
+    versaoCaderno++;
+}
+
+// Função para buscar a entrada (mais recente) associada a uma pista
+EntradaHash* buscarEntradaHash(const char* pista) {
     if (pista == NULL || strlen(pista) == 0) {
-        return "Nenhum suspeito associado";
+        return NULL;
     }
     
     int indice = funcaoHash(pista);
@@ -95,93 +333,338 @@ char* buscarSuspeito(const char* pista) {
     
     while (atual != NULL) {
         if (strcmp(atual->pista, pista) == 0) {
-            return atual->suspeito;
+            return atual;
         }
         atual = atual->proximo;
     }
     
-    return "Nenhum suspeito associado";
+    return NULL;
 }
 
-// Função para atualizar contagem de suspeitos
-void atualizarContadorSuspeito(const char* suspeito) {
-    if (strcmp(suspeito, "Nenhum suspeito associado") == 0) {
-        return;
+// Função para buscar suspeito associado a uma pista
+char* buscarSuspeito(const char* pista) {
+    EntradaHash* entrada = buscarEntradaHash(pista);
+    if (entrada == NULL) {
+        return "Nenhum suspeito associado";
+    }
+    return entrada->suspeito;
+}
+
+// Função para marcar uma pista como coletada no índice reverso.
+// Retorna a entrada se a pista acabou de ser marcada, ou NULL.
+EntradaHash* marcarPistaColetada(const char* pista) {
+    EntradaHash* entrada = buscarEntradaHash(pista);
+    if (entrada == NULL || entrada->coletada) {
+        return NULL;
+    }
+    entrada->coletada = 1;
+    FichaSuspeito* ficha = entrada->ficha;
+    if (++ficha->pistasColetadas == 1) {
+        ficha->ordemPrimeiraColeta = suspeitosComColeta++;
     }
     
-    ContadorSuspeito* atual = listaSuspeitos;
-    ContadorSuspeito* anterior = NULL;
+    // Em caso de empate vence quem teve a primeira pista coletada antes
+    if (fichaMaisCitada == NULL || ficha->pistasColetadas > fichaMaisCitada->pistasColetadas ||
+        (ficha->pistasColetadas == fichaMaisCitada->pistasColetadas &&
+         ficha->ordemPrimeiraColeta < fichaMaisCitada->ordemPrimeiraColeta)) {
+        fichaMaisCitada = ficha;
+    }
+    return entrada;
+}
+
+// Função para definir o peso de uma pista já associada
+void definirPesoPista(const char* pista, int peso) {
+    EntradaHash* entrada = buscarEntradaHash(pista);
+    if (entrada != NULL) {
+        entrada->peso = peso;
+    }
+}
+
+// Função para configurar o decaimento: a cada meiaVida movimentos uma evidência
+// passa a valer metade. Os fatores são tabelados em ponto fixo até chegarem a zero,
+// para que aplicar o decaimento custe uma consulta e uma multiplicação.
+// meiaVida <= 0 desativa o decaimento.
+void configurarDecaimento(int meiaVida) {
+    free(fatorDecaimento);
+    fatorDecaimento = NULL;
+    limiteDecaimento = 0;
+    meiaVidaDecaimento = meiaVida > 0 ? meiaVida : 0;
+    if (meiaVida <= 0) {
+        return;
+    }
     
-    // Buscar suspeito na lista
-    while (atual != NULL) {
-        if (strcmp(atual->nome, suspeito) == 0) {
-            atual->contagem++;
-            return;
+    // Fator por movimento: raiz meiaVida-ésima de 1/2, por bissecção
+    // (pow exigiria -lm, que a tarefa de compilação do VS Code não passa ao gcc)
+    double baixo = 0.0, alto = 1.0;
+    for (int iteracao = 0; iteracao < 60; iteracao++) {
+        double meio = (baixo + alto) / 2.0;
+        double potencia = 1.0;
+        for (int i = 0; i < meiaVida; i++) {
+            potencia *= meio;
+        }
+        if (potencia < 0.5) {
+            baixo = meio;
+        } else {
+            alto = meio;
         }
-        anterior = atual;
-        atual = atual->proximo;
     }
     
-    // Suspeito não encontrado, criar novo
-    ContadorSuspeito* novo = (ContadorSuspeito*)malloc(sizeof(ContadorSuspeito));
-    if (novo == NULL) {
+    // A tabela vai até o primeiro fator que arredonda para zero em 16 bits
+    // fracionários (um pouco além de 16 meias-vidas); dali em diante a pontuação é zero
+    double fator = 1.0;
+    limiteDecaimento = 0;
+    while ((unsigned int)(fator * ESCALA_DECAIMENTO + 0.5) != 0) {
+        fator *= baixo;
+        limiteDecaimento++;
+    }
+    fatorDecaimento = (unsigned int*)malloc((limiteDecaimento + 1) * sizeof(unsigned int));
+    if (fatorDecaimento == NULL) {
         printf("Erro de alocação de memória!\n");
         exit(1);
     }
-    strcpy(novo->nome, suspeito);
-    novo->contagem = 1;
-    novo->proximo = NULL;
-    
-    if (listaSuspeitos == NULL) {
-        listaSuspeitos = novo;
-    } else {
-        anterior->proximo = novo;
+    fator = 1.0;
+    for (int i = 0; i <= limiteDecaimento; i++) {
+        fatorDecaimento[i] = (unsigned int)(fator * ESCALA_DECAIMENTO + 0.5);
+        fator *= baixo;
     }
 }
 
-// Função para encontrar o suspeito mais citado
-void encontrarSuspeitoMaisCitado() {
-    if (listaSuspeitos == NULL) {
-        printf("Nenhuma pista coletada para análise.\n");
+// Função para trazer a pontuação de um suspeito até o movimento atual
+void aplicarDecaimento(FichaSuspeito* ficha) {
+    int decorridos = movimentosExploracao - ficha->movimentoPontuacao;
+    if (decorridos > 0 && fatorDecaimento != NULL) {
+        if (decorridos > limiteDecaimento) {
+            ficha->pontuacao = 0;
+        } else {
+            ficha->pontuacao = (ficha->pontuacao * fatorDecaimento[decorridos]) / ESCALA_DECAIMENTO;
+        }
+    }
+    ficha->movimentoPontuacao = movimentosExploracao;
+}
+
+// Função para somar uma evidência coletada à pontuação do suspeito (O(1))
+void registrarEvidencia(EntradaHash* entrada, const Sala* sala) {
+    FichaSuspeito* ficha = entrada->ficha;
+    aplicarDecaimento(ficha);
+    ficha->pontuacao += (long long)sala->peso * entrada->peso;
+}
+
+// Função para exibir as pistas de um suspeito (todas ou só as coletadas).
+// Percorre apenas a lista do próprio suspeito, sem varrer a tabela hash.
+void exibirPistasDoSuspeito(const char* nome, int somenteColetadas) {
+    FichaSuspeito* ficha = obterFichaSuspeito(nome, 0);
+    if (ficha == NULL) {
+        printf("Nenhuma pista associada a %s.\n", nome);
         return;
     }
     
-    ContadorSuspeito* atual = listaSuspeitos;
-    ContadorSuspeito* maisCitado = listaSuspeitos;
+    if (somenteColetadas) {
+        printf("Pistas coletadas contra %s (%d de %d):\n",
+               ficha->nome, ficha->pistasColetadas, ficha->totalPistas);
+        if (ficha->pistasColetadas == 0) {
+            printf("Nenhuma pista coletada ainda.\n");
+            return;
+        }
+    } else {
+        printf("Todas as pistas contra %s (%d no total):\n", ficha->nome, ficha->totalPistas);
+    }
     
-    while (atual != NULL) {
-        if (atual->contagem > maisCitado->contagem) {
-            maisCitado = atual;
+    for (EntradaHash* atual = ficha->pistas; atual != NULL; atual = atual->proximoDoSuspeito) {
+        if (somenteColetadas && !atual->coletada) {
+            continue;
         }
-        atual = atual->proximo;
+        printf("🔍 %s%s\n", atual->pista, (!somenteColetadas && atual->coletada) ? " (coletada)" : "");
+    }
+}
+
+// Função para encontrar o suspeito mais citado
+FichaSuspeito* encontrarSuspeitoMaisCitado() {
+    if (fichaMaisCitada == NULL) {
+        printf("Nenhuma pista coletada para análise.\n");
+        return NULL;
     }
     
     printf("\n🔎 === SUSPEITO MAIS CITADO ===\n");
-    printf("Nome: %s\n", maisCitado->nome);
-    printf("Menções: %d pistas associadas\n", maisCitado->contagem);
+    printf("Nome: %s\n", fichaMaisCitada->nome);
+    printf("Menções: %d pistas associadas\n", fichaMaisCitada->pistasColetadas);
+    exibirPistasDoSuspeito(fichaMaisCitada->nome, 1);
     printf("===============================\n");
+    return fichaMaisCitada;
 }
 
-// Função para exibir todas as associações pista → suspeito
-void exibirAssociacoesPistasSuspeitos() {
-    printf("\n📋 === ASSOCIAÇÕES PISTA → SUSPEITO ===\n");
-    int totalAssociacoes = 0;
+// Função de comparação de fichas por pontuação (decrescente) para qsort.
+// Empates: mais pistas coletadas e, por fim, a primeira pista coletada antes.
+int compararFichasPorPontuacao(const void* a, const void* b) {
+    const FichaSuspeito* fichaA = *(FichaSuspeito* const*)a;
+    const FichaSuspeito* fichaB = *(FichaSuspeito* const*)b;
+    if (fichaA->pontuacao != fichaB->pontuacao) {
+        return fichaA->pontuacao < fichaB->pontuacao ? 1 : -1;
+    }
+    if (fichaA->pistasColetadas != fichaB->pistasColetadas) {
+        return fichaB->pistasColetadas - fichaA->pistasColetadas;
+    }
+    return fichaA->ordemPrimeiraColeta - fichaB->ordemPrimeiraColeta;
+}
+
+// Função para exibir o ranking ponderado ao lado da contagem bruta de pistas.
+// Retorna o primeiro colocado (NULL se nenhuma pista foi coletada).
+FichaSuspeito* exibirRankingPonderado() {
+    int quantidade = 0;
+    for (int i = 0; i < TAMANHO_INDICE_SUSPEITOS; i++) {
+        for (FichaSuspeito* atual = indiceSuspeitos[i]; atual != NULL; atual = atual->proximo) {
+            if (atual->pistasColetadas > 0) {
+                quantidade++;
+            }
+        }
+    }
     
-    for (int i = 0; i < TAMANHO_HASH; i++) {
-        EntradaHash* atual = tabelaHash[i];
-        while (atual != NULL) {
-            printf("🔍 \"%s\" → %s\n", atual->pista, atual->suspeito);
-            totalAssociacoes++;
-            atual = atual->proximo;
+    printf("\n⚖️  === RANKING PONDERADO (peso da sala × peso da pista) ===\n");
+    if (meiaVidaDecaimento > 0) {
+        printf("Meia-vida das evidências: %d movimentos (total: %d)\n",
+               meiaVidaDecaimento, movimentosExploracao);
+    }
+    if (quantidade == 0) {
+        printf("Nenhuma pista coletada para análise.\n");
+        printf("=====================================\n");
+        return NULL;
+    }
+    
+    FichaSuspeito** fichas = (FichaSuspeito**)malloc(quantidade * sizeof(FichaSuspeito*));
+    if (fichas == NULL) {
+        printf("Erro de alocação de memória!\n");
+        exit(1);
+    }
+    int n = 0;
+    for (int i = 0; i < TAMANHO_INDICE_SUSPEITOS; i++) {
+        for (FichaSuspeito* atual = indiceSuspeitos[i]; atual != NULL; atual = atual->proximo) {
+            if (atual->pistasColetadas > 0) {
+                aplicarDecaimento(atual);
+                fichas[n++] = atual;
+            }
         }
     }
+    qsort(fichas, quantidade, sizeof(FichaSuspeito*), compararFichasPorPontuacao);
     
-    if (totalAssociacoes == 0) {
-        printf("Nenhuma associação registrada.\n");
-    } else {
-        printf("Total de associações: %d\n", totalAssociacoes);
+    for (int i = 0; i < quantidade; i++) {
+        printf("%d. %s → pontuação: %.2f | pistas coletadas: %d\n", i + 1, fichas[i]->nome,
+               (double)fichas[i]->pontuacao / (PESO_NORMAL * PESO_NORMAL),
+               fichas[i]->pistasColetadas);
     }
     printf("=====================================\n");
+    FichaSuspeito* primeiro = fichas[0];
+    free(fichas);
+    return primeiro;
+}
+
+// Função para acrescentar uma linha formatada a uma visão
+void anexarLinha(VisaoRenderizada* visao, const char* formato, ...) {
+    va_list argumentos;
+    va_start(argumentos, formato);
+    int tamanhoLinha = vsnprintf(NULL, 0, formato, argumentos);
+    va_end(argumentos);
+    
+    if (visao->tamanho + tamanhoLinha + 1 > visao->capacidade) {
+        size_t novaCapacidade = visao->capacidade == 0 ? 4096 : visao->capacidade;
+        while (visao->tamanho + tamanhoLinha + 1 > novaCapacidade) {
+            novaCapacidade *= 2;
+        }
+        visao->texto = (char*)realloc(visao->texto, novaCapacidade);
+        if (visao->texto == NULL) {
+            printf("Erro de alocação de memória!\n");
+            exit(1);
+        }
+        visao->capacidade = novaCapacidade;
+    }
+    if (visao->totalLinhas == visao->capacidadeLinhas) {
+        visao->capacidadeLinhas = visao->capacidadeLinhas == 0 ? 64 : visao->capacidadeLinhas * 2;
+        visao->inicioLinha = (size_t*)realloc(visao->inicioLinha,
+                                              (visao->capacidadeLinhas + 1) * sizeof(size_t));
+        if (visao->inicioLinha == NULL) {
+            printf("Erro de alocação de memória!\n");
+            exit(1);
+        }
+    }
+    
+    va_start(argumentos, formato);
+    vsnprintf(visao->texto + visao->tamanho, tamanhoLinha + 1, formato, argumentos);
+    va_end(argumentos);
+    
+    visao->inicioLinha[visao->totalLinhas++] = visao->tamanho;
+    visao->tamanho += tamanhoLinha;
+    visao->inicioLinha[visao->totalLinhas] = visao->tamanho;  // Fim da última linha
+}
+
+// Função para esvaziar uma visão antes de renderizá-la novamente
+void limparVisao(VisaoRenderizada* visao) {
+    visao->tamanho = 0;
+    visao->totalLinhas = 0;
+    visao->valida = 0;
+}
+
+// Função para exibir um trecho (deslocamento + quantidade de linhas) de uma visão
+void exibirLinhasVisao(const VisaoRenderizada* visao, int primeiraLinha, int quantidadeLinhas) {
+    if (primeiraLinha < 0) {
+        primeiraLinha = 0;
+    }
+    int ultimaLinha = primeiraLinha + quantidadeLinhas;
+    if (ultimaLinha > visao->totalLinhas) {
+        ultimaLinha = visao->totalLinhas;
+    }
+    if (primeiraLinha >= ultimaLinha) {
+        return;
+    }
+    size_t inicio = visao->inicioLinha[primeiraLinha];
+    fwrite(visao->texto + inicio, 1, visao->inicioLinha[ultimaLinha] - inicio, stdout);
+}
+
+// Função para limitar a página pedida ao intervalo existente e devolver o total de páginas
+int limitarPagina(int* pagina, int totalLinhas) {
+    int totalPaginas = (totalLinhas + LINHAS_POR_PAGINA - 1) / LINHAS_POR_PAGINA;
+    if (totalPaginas == 0) {
+        totalPaginas = 1;
+    }
+    if (*pagina >= totalPaginas) {
+        *pagina = totalPaginas - 1;
+    }
+    if (*pagina < 0) {
+        *pagina = 0;
+    }
+    return totalPaginas;
+}
+
+// Função para registrar uma nova coleta: entra no registro de novidades e
+// invalida a visão do caderno
+void registrarColeta(Pista* pista) {
+    if (totalColetas == capacidadeColetas) {
+        capacidadeColetas = capacidadeColetas == 0 ? 16 : capacidadeColetas * 2;
+        registroColetas = (Pista**)realloc(registroColetas, capacidadeColetas * sizeof(Pista*));
+        if (registroColetas == NULL) {
+            printf("Erro de alocação de memória!\n");
+            exit(1);
+        }
+    }
+    registroColetas[totalColetas++] = pista;
+    versaoCaderno++;
+}
+
+// Função para exibir apenas as pistas coletadas que ainda não apareceram na tela
+// (as que já saíram numa página do caderno são puladas)
+void exibirNovidadesCaderno() {
+    printf("\n🆕 === NOVIDADES NO CADERNO ===\n");
+    int exibidas = 0;
+    for (int i = coletasVistas; i < totalColetas; i++) {
+        Pista* pista = registroColetas[i];
+        if (!pista->vista) {
+            printf("🔍 %s → Suspeito: %s\n", pista->descricao, buscarSuspeito(pista->descricao));
+            pista->vista = 1;
+            exibidas++;
+        }
+    }
+    coletasVistas = totalColetas;
+    if (exibidas == 0) {
+        printf("Nenhuma pista nova desde a última consulta.\n");
+    }
+    printf("==============================\n");
 }
 
 // Função para criar uma nova sala
@@ -191,97 +674,345 @@ Sala* criarSala(const char* nome, const char* pista) {
         printf("Erro de alocação de memória!\n");
         exit(1);
     }
-    strcpy(novaSala->nome, nome);
-    strcpy(novaSala->pista, pista);
+    copiarTexto(novaSala->nome, nome, sizeof(novaSala->nome));
+    copiarTexto(novaSala->pista, pista, sizeof(novaSala->pista));
+    novaSala->peso = PESO_NORMAL;
     novaSala->esquerda = NULL;
     novaSala->direita = NULL;
     return novaSala;
 }
 
-// Função para inserir uma pista na BST (ordem alfabética)
-Pista* inserirPista(Pista* raiz, const char* descricao) {
+// Letra base para os caracteres acentuados do Latin-1 (segundo byte de 0xC3 0x80..0xBF).
+// '.' indica que o caractere não tem equivalente sem acento e é mantido como está.
+static const char letraBaseLatin1[64] =
+    "aaaaaa.ceeeeiiii.nooooo.ouuuuy.."
+    "aaaaaa.ceeeeiiii.nooooo.ouuuuy.y";
+
+// Função para gerar a chave de ordenação de uma pista. No modo português a chave é
+// o texto sem maiúsculas nem acentos, um byte 0 separador e o texto original como
+// desempate; assim basta memcmp para ordenar e pistas diferentes nunca empatam.
+// Retorna o tamanho da chave.
+int gerarChaveColacao(const char* texto, unsigned char* chave) {
+    const unsigned char* c = (const unsigned char*)texto;
+    int tamanho = 0;
+    int tamanhoTexto = (int)strlen(texto);
+    if (tamanhoTexto >= TAMANHO_PISTA) {
+        tamanhoTexto = TAMANHO_PISTA - 1;  // Mesmo truncamento de copiarTexto
+    }
+    
+    if (modoColacao == COLACAO_BINARIA) {
+        memcpy(chave, texto, tamanhoTexto);
+        return tamanhoTexto;
+    }
+    
+    for (int i = 0; i < tamanhoTexto; i++) {
+        if (c[i] == 0xC3 && i + 1 < tamanhoTexto && c[i + 1] >= 0x80 && c[i + 1] <= 0xBF &&
+            letraBaseLatin1[c[i + 1] - 0x80] != '.') {
+            chave[tamanho++] = (unsigned char)letraBaseLatin1[c[i + 1] - 0x80];
+            i++;
+        } else if (c[i] < 0x80) {
+            chave[tamanho++] = (unsigned char)tolower(c[i]);
+        } else {
+            chave[tamanho++] = c[i];
+        }
+    }
+    chave[tamanho++] = 0;
+    memcpy(chave + tamanho, texto, tamanhoTexto);
+    return tamanho + tamanhoTexto;
+}
+
+// Função para comparar duas chaves de ordenação (mesmo sinal que strcmp)
+int compararChaves(const unsigned char* a, int tamanhoA, const unsigned char* b, int tamanhoB) {
+    int comparacao = memcmp(a, b, tamanhoA < tamanhoB ? tamanhoA : tamanhoB);
+    if (comparacao != 0) {
+        return comparacao;
+    }
+    return tamanhoA - tamanhoB;
+}
+
+// Função para contar o total de pistas de uma subárvore (contador mantido na inserção)
+int contarPistas(Pista* raiz) {
+    return raiz == NULL ? 0 : raiz->tamanho;
+}
+
+// Função auxiliar para inserir na BST com a chave já calculada
+Pista* inserirPistaComChave(Pista* raiz, const char* descricao,
+                            const unsigned char* chave, int tamanhoChave) {
     if (raiz == NULL) {
         Pista* novaPista = (Pista*)malloc(sizeof(Pista));
         if (novaPista == NULL) {
             printf("Erro de alocação de memória!\n");
             exit(1);
         }
-        strcpy(novaPista->descricao, descricao);
+        copiarTexto(novaPista->descricao, descricao, sizeof(novaPista->descricao));
+        memcpy(novaPista->chave, chave, tamanhoChave);
+        novaPista->tamanhoChave = tamanhoChave;
+        novaPista->tamanho = 1;
+        novaPista->vista = 0;
         novaPista->esquerda = NULL;
         novaPista->direita = NULL;
         return novaPista;
     }
     
-    int comparacao = strcmp(descricao, raiz->descricao);
+    int comparacao = compararChaves(chave, tamanhoChave, raiz->chave, raiz->tamanhoChave);
     
     if (comparacao < 0) {
-        raiz->esquerda = inserirPista(raiz->esquerda, descricao);
+        raiz->esquerda = inserirPistaComChave(raiz->esquerda, descricao, chave, tamanhoChave);
     } else if (comparacao > 0) {
-        raiz->direita = inserirPista(raiz->direita, descricao);
+        raiz->direita = inserirPistaComChave(raiz->direita, descricao, chave, tamanhoChave);
     }
+    raiz->tamanho = 1 + contarPistas(raiz->esquerda) + contarPistas(raiz->direita);
     
     return raiz;
 }
 
-// Função para buscar uma pista na BST
-int buscarPista(Pista* raiz, const char* descricao) {
+// Função para inserir uma pista na BST (ordem alfabética conforme modoColacao)
+Pista* inserirPista(Pista* raiz, const char* descricao) {
+    unsigned char chave[TAMANHO_CHAVE];
+    int tamanhoChave = gerarChaveColacao(descricao, chave);
+    return inserirPistaComChave(raiz, descricao, chave, tamanhoChave);
+}
+
+// Função de comparação de nós do caderno (vetor de ponteiros) para qsort
+int compararNosCaderno(const void* a, const void* b) {
+    const Pista* pistaA = *(Pista* const*)a;
+    const Pista* pistaB = *(Pista* const*)b;
+    return compararChaves(pistaA->chave, pistaA->tamanhoChave, pistaB->chave, pistaB->tamanhoChave);
+}
+
+// Função auxiliar: liga os nós com o elemento do meio como raiz da subárvore
+Pista* ligarSubarvoreBalanceada(Pista* nos[], int inicio, int fim) {
+    if (inicio > fim) {
+        return NULL;
+    }
+    int meio = inicio + (fim - inicio) / 2;
+    nos[meio]->esquerda = ligarSubarvoreBalanceada(nos, inicio, meio - 1);
+    nos[meio]->direita = ligarSubarvoreBalanceada(nos, meio + 1, fim);
+    nos[meio]->tamanho = fim - inicio + 1;
+    return nos[meio];
+}
+
+// Função para montar um caderno perfeitamente balanceado em O(n) a partir de
+// pistas já na ordem de modoColacao. Se a entrada não estiver ordenada ela é
+// ordenada antes (O(n log n)). Duplicatas são ignoradas, como em inserirPista.
+Pista* construirCadernoBalanceado(const char* pistasOrdenadas[], int quantidade) {
+    if (quantidade <= 0) {
+        return NULL;
+    }
+    
+    Pista** nos = (Pista**)malloc(quantidade * sizeof(Pista*));
+    if (nos == NULL) {
+        printf("Erro de alocação de memória!\n");
+        exit(1);
+    }
+    
+    // Criar os nós já com a chave calculada, verificando se a entrada está em ordem
+    int ordenado = 1;
+    for (int i = 0; i < quantidade; i++) {
+        nos[i] = (Pista*)malloc(sizeof(Pista));
+        if (nos[i] == NULL) {
+            printf("Erro de alocação de memória!\n");
+            exit(1);
+        }
+        copiarTexto(nos[i]->descricao, pistasOrdenadas[i], sizeof(nos[i]->descricao));
+        nos[i]->tamanhoChave = gerarChaveColacao(nos[i]->descricao, nos[i]->chave);
+        nos[i]->vista = 0;
+        if (i > 0 && compararNosCaderno(&nos[i - 1], &nos[i]) > 0) {
+            ordenado = 0;
+        }
+    }
+    if (!ordenado) {
+        qsort(nos, quantidade, sizeof(Pista*), compararNosCaderno);
+    }
+    
+    // Remover duplicatas (adjacentes após a ordenação)
+    int unicas = 0;
+    for (int i = 0; i < quantidade; i++) {
+        if (unicas > 0 && compararNosCaderno(&nos[i], &nos[unicas - 1]) == 0) {
+            free(nos[i]);
+            continue;
+        }
+        nos[unicas++] = nos[i];
+    }
+    
+    Pista* raiz = ligarSubarvoreBalanceada(nos, 0, unicas - 1);
+    free(nos);
+    return raiz;
+}
+
+// Função auxiliar para localizar o nó da BST com a chave já calculada (NULL se não existir)
+Pista* localizarPistaComChave(Pista* raiz, const unsigned char* chave, int tamanhoChave) {
     if (raiz == NULL) {
-        return 0;
+        return NULL;
     }
     
-    int comparacao = strcmp(descricao, raiz->descricao);
+    int comparacao = compararChaves(chave, tamanhoChave, raiz->chave, raiz->tamanhoChave);
     
     if (comparacao == 0) {
-        return 1;
+        return raiz;
     } else if (comparacao < 0) {
-        return buscarPista(raiz->esquerda, descricao);
+        return localizarPistaComChave(raiz->esquerda, chave, tamanhoChave);
     } else {
-        return buscarPista(raiz->direita, descricao);
+        return localizarPistaComChave(raiz->direita, chave, tamanhoChave);
     }
 }
 
-// Função para exibir todas as pistas em ordem alfabética
-void exibirPistasEmOrdem(Pista* raiz) {
-    if (raiz != NULL) {
-        exibirPistasEmOrdem(raiz->esquerda);
-        char* suspeito = buscarSuspeito(raiz->descricao);
-        printf("🔍 %s → Suspeito: %s\n", raiz->descricao, suspeito);
-        exibirPistasEmOrdem(raiz->direita);
+// Função para localizar o nó de uma pista na BST
+Pista* localizarPista(Pista* raiz, const char* descricao) {
+    unsigned char chave[TAMANHO_CHAVE];
+    int tamanhoChave = gerarChaveColacao(descricao, chave);
+    return localizarPistaComChave(raiz, chave, tamanhoChave);
+}
+
+// Função para buscar uma pista na BST
+int buscarPista(Pista* raiz, const char* descricao) {
+    return localizarPista(raiz, descricao) != NULL;
+}
+
+// Função auxiliar: formata as linhas [*pular, *pular + *restantes) do percurso em ordem,
+// descendo apenas nas subárvores que contêm linhas do trecho. Marca as pistas como vistas.
+void renderizarTrechoCaderno(Pista* raiz, int* pular, int* restantes, VisaoRenderizada* visao) {
+    if (raiz == NULL || *restantes == 0) {
+        return;
     }
+    int tamanhoEsquerda = contarPistas(raiz->esquerda);
+    if (*pular >= tamanhoEsquerda) {
+        *pular -= tamanhoEsquerda;
+    } else {
+        renderizarTrechoCaderno(raiz->esquerda, pular, restantes, visao);
+    }
+    if (*restantes == 0) {
+        return;
+    }
+    if (*pular > 0) {
+        (*pular)--;
+    } else {
+        anexarLinha(visao, "🔍 %s → Suspeito: %s\n", raiz->descricao, buscarSuspeito(raiz->descricao));
+        raiz->vista = 1;
+        (*restantes)--;
+    }
+    renderizarTrechoCaderno(raiz->direita, pular, restantes, visao);
 }
 
-// Função para contar o total de pistas coletadas
-int contarPistas(Pista* raiz) {
+// Função para obter um trecho do caderno em ordem alfabética. Só o trecho pedido é
+// formatado (O(altura + linhas)), e ele é reaproveitado enquanto não houver nova coleta.
+VisaoRenderizada* obterVisaoCaderno(Pista* raiz, int primeiraLinha, int quantidadeLinhas) {
+    if (!visaoCaderno.valida || visaoCaderno.versao != versaoCaderno ||
+        visaoCaderno.primeiraLinha != primeiraLinha ||
+        visaoCaderno.quantidadeLinhas != quantidadeLinhas) {
+        limparVisao(&visaoCaderno);
+        int pular = primeiraLinha;
+        int restantes = quantidadeLinhas;
+        renderizarTrechoCaderno(raiz, &pular, &restantes, &visaoCaderno);
+        visaoCaderno.primeiraLinha = primeiraLinha;
+        visaoCaderno.quantidadeLinhas = quantidadeLinhas;
+        visaoCaderno.versao = versaoCaderno;
+        visaoCaderno.valida = 1;
+    }
+    return &visaoCaderno;
+}
+
+// Função para obter a visão das associações, refazendo-a só se a tabela mudou
+VisaoRenderizada* obterVisaoAssociacoes() {
+    if (!visaoAssociacoes.valida || visaoAssociacoes.versao != versaoAssociacoes) {
+        limparVisao(&visaoAssociacoes);
+        for (int i = 0; i < tamanhoHash; i++) {
+            for (EntradaHash* atual = tabelaHash[i]; atual != NULL; atual = atual->proximo) {
+                anexarLinha(&visaoAssociacoes, "🔍 \"%s\" → %s\n", atual->pista, atual->suspeito);
+            }
+        }
+        visaoAssociacoes.primeiraLinha = 0;
+        visaoAssociacoes.quantidadeLinhas = visaoAssociacoes.totalLinhas;
+        visaoAssociacoes.versao = versaoAssociacoes;
+        visaoAssociacoes.valida = 1;
+    }
+    return &visaoAssociacoes;
+}
+
+// Função para exibir uma página do caderno; o título usa os totais do momento.
+// Retorna a página efetivamente exibida.
+int exibirPaginaCaderno(Pista* raiz, int pagina) {
+    int total = contarPistas(raiz);
+    int totalPaginas = limitarPagina(&pagina, total);
+    
+    printf("\n📓 === CADERNO DE PISTAS E SUSPEITOS ===\n");
+    if (total == 0) {
+        printf("Nenhuma pista coletada ainda.\n");
+    } else {
+        printf("Pistas coletadas (%d no total):\n", total);
+        VisaoRenderizada* visao = obterVisaoCaderno(raiz, pagina * LINHAS_POR_PAGINA, LINHAS_POR_PAGINA);
+        exibirLinhasVisao(visao, 0, visao->totalLinhas);
+    }
+    printf("--- Página %d de %d ([>] próxima | [<] anterior) ---\n", pagina + 1, totalPaginas);
+    return pagina;
+}
+
+// Função para exibir uma página das associações; o título usa os totais do momento.
+// Retorna a página efetivamente exibida.
+int exibirPaginaAssociacoes(int pagina) {
+    VisaoRenderizada* visao = obterVisaoAssociacoes();
+    int totalPaginas = limitarPagina(&pagina, visao->totalLinhas);
+    
+    printf("\n📋 === ASSOCIAÇÕES PISTA → SUSPEITO ===\n");
+    if (totalEntradasHash == 0) {
+        printf("Nenhuma associação registrada.\n");
+    } else {
+        printf("Total de associações: %d\n", totalEntradasHash);
+        exibirLinhasVisao(visao, pagina * LINHAS_POR_PAGINA, LINHAS_POR_PAGINA);
+    }
+    printf("--- Página %d de %d ([>] próxima | [<] anterior) ---\n", pagina + 1, totalPaginas);
+    return pagina;
+}
+
+// Função para calcular a altura da árvore de pistas
+int alturaArvorePistas(Pista* raiz) {
     if (raiz == NULL) {
         return 0;
     }
-    return 1 + contarPistas(raiz->esquerda) + contarPistas(raiz->direita);
+    int alturaEsquerda = alturaArvorePistas(raiz->esquerda);
+    int alturaDireita = alturaArvorePistas(raiz->direita);
+    return 1 + (alturaEsquerda > alturaDireita ? alturaEsquerda : alturaDireita);
+}
+
+// Função para coletar a pista da sala, se houver e ainda não tiver sido coletada.
+// Retorna 1 quando uma nova pista entra no caderno.
+int coletarPistaDaSala(Sala* sala, Pista** arvorePistas) {
+    if (strlen(sala->pista) == 0 || buscarPista(*arvorePistas, sala->pista) != 0) {
+        return 0;
+    }
+    *arvorePistas = inserirPista(*arvorePistas, sala->pista);
+    registrarColeta(localizarPista(*arvorePistas, sala->pista));
+    
+    // Atualizar contagem e pontuação do suspeito associado
+    EntradaHash* entrada = marcarPistaColetada(sala->pista);
+    if (entrada != NULL) {
+        registrarEvidencia(entrada, sala);
+    }
+    return 1;
 }
 
 // Função para explorar as salas interativamente
 void explorarSalas(Sala* raiz, Pista** arvorePistas) {
     Sala* salaAtual = raiz;
     char opcao;
+    char nomeSuspeito[TAMANHO_NOME];
+    char listagemAtual = 0;  // Última listagem paginada exibida ('p' ou 'a')
+    int paginaAtual = 0;
     
     printf("🔍 Bem-vindo ao Detective Quest - Nível Mestre!\n");
     printf("Explore a mansão usando as opções:\n");
     printf("'e' - ir para esquerda | 'd' - ir para direita\n");
     printf("'p' - ver pistas e suspeitos | 'a' - ver associações\n");
+    printf("'u' - ver pistas de um suspeito | 'n' - ver pistas novas\n");
+    printf("'>' / '<' - próxima / anterior página da última listagem\n");
     printf("'s' - sair e resolver caso\n\n");
     
     while (salaAtual != NULL) {
         printf("\n=========================================\n");
         printf("Você está no: %s\n", salaAtual->nome);
         
-        // Verifica se há pista nesta sala e ainda não foi coletada
-        if (strlen(salaAtual->pista) > 0 && 
-            buscarPista(*arvorePistas, salaAtual->pista) == 0) {
+        if (coletarPistaDaSala(salaAtual, arvorePistas)) {
             printf("🎯 Você encontrou uma pista: \"%s\"\n", salaAtual->pista);
-            *arvorePistas = inserirPista(*arvorePistas, salaAtual->pista);
-            
-            // Buscar suspeito associado e atualizar contador
-            char* suspeito = buscarSuspeito(salaAtual->pista);
-            atualizarContadorSuspeito(suspeito);
         }
         
         // Verifica se é um nó folha
@@ -294,7 +1025,7 @@ void explorarSalas(Sala* raiz, Pista** arvorePistas) {
         printf("\nOpções de navegação: ");
         if (salaAtual->esquerda != NULL) printf("[e] Esquerda ");
         if (salaAtual->direita != NULL) printf("[d] Direita ");
-        printf("\nOutras opções: [p] Ver Pistas | [a] Associações | [s] Sair\n");
+        printf("\nOutras opções: [p] Ver Pistas | [a] Associações | [u] Suspeito | [n] Novidades | [s] Sair\n");
         
         printf("\nPara onde deseja ir? ");
         scanf(" %c", &opcao);
@@ -303,6 +1034,7 @@ void explorarSalas(Sala* raiz, Pista** arvorePistas) {
             case 'e':
                 if (salaAtual->esquerda != NULL) {
                     salaAtual = salaAtual->esquerda;
+                    movimentosExploracao++;
                 } else {
                     printf("❌ Não há sala à esquerda!\n");
                 }
@@ -310,28 +1042,48 @@ void explorarSalas(Sala* raiz, Pista** arvorePistas) {
             case 'd':
                 if (salaAtual->direita != NULL) {
                     salaAtual = salaAtual->direita;
+                    movimentosExploracao++;
                 } else {
                     printf("❌ Não há sala à direita!\n");
                 }
                 break;
             case 'p':
-                printf("\n📓 === CADERNO DE PISTAS E SUSPEITOS ===\n");
-                if (*arvorePistas == NULL) {
-                    printf("Nenhuma pista coletada ainda.\n");
+                paginaAtual = exibirPaginaCaderno(*arvorePistas, 0);
+                listagemAtual = 'p';
+                break;
+            case 'a':
+                paginaAtual = exibirPaginaAssociacoes(0);
+                listagemAtual = 'a';
+                break;
+            case '>':
+            case '<':
+                if (listagemAtual == 0) {
+                    printf("❌ Use 'p' ou 'a' antes de trocar de página.\n");
+                } else if (listagemAtual == 'p') {
+                    paginaAtual = exibirPaginaCaderno(*arvorePistas, paginaAtual + (opcao == '>' ? 1 : -1));
                 } else {
-                    printf("Pistas coletadas (%d no total):\n", contarPistas(*arvorePistas));
-                    exibirPistasEmOrdem(*arvorePistas);
+                    paginaAtual = exibirPaginaAssociacoes(paginaAtual + (opcao == '>' ? 1 : -1));
                 }
-                printf("======================================\n");
                 break;
-            case 'a':
-                exibirAssociacoesPistasSuspeitos();
+            case 'n':
+                exibirNovidadesCaderno();
+                break;
+            case 'u':
+                printf("Nome do suspeito: ");
+                if (scanf(" %49[^\n]", nomeSuspeito) == 1) {
+                    printf("\n🕵️ === EVIDÊNCIAS CONTRA %s ===\n", nomeSuspeito);
+                    exibirPistasDoSuspeito(nomeSuspeito, 0);
+                    if (obterFichaSuspeito(nomeSuspeito, 0) != NULL) {
+                        exibirPistasDoSuspeito(nomeSuspeito, 1);
+                    }
+                    printf("======================================\n");
+                }
                 break;
             case 's':
                 printf("👋 Saindo da exploração...\n");
                 return;
             default:
-                printf("❌ Opção inválida! Use 'e', 'd', 'p', 'a' ou 's'.\n");
+                printf("❌ Opção inválida! Use 'e', 'd', 'p', 'a', 'u', 'n', '>', '<' ou 's'.\n");
         }
     }
 }
@@ -351,14 +1103,281 @@ void inicializarAssociacoes() {
     inserirNaHash("Cinzas de cigarro raro", "Carlos");
 }
 
+// Função auxiliar para medir tempo decorrido em milissegundos
+double milissegundosDesde(clock_t inicio) {
+    return 1000.0 * (double)(clock() - inicio) / CLOCKS_PER_SEC;
+}
+
+// Função para comparar inserções individuais com a construção em lote
+void executarBenchmark(int quantidade) {
+    printf("⏱️  === BENCHMARK: CONSTRUÇÃO EM LOTE (%d pistas) ===\n", quantidade);
+    
+    // Gerar pistas sintéticas já em ordem alfabética e suspeitos associados
+    char (*textos)[TAMANHO_PISTA] = malloc(quantidade * sizeof(*textos));
+    const char** pistas = (const char**)malloc(quantidade * sizeof(char*));
+    const char** embaralhadas = (const char**)malloc(quantidade * sizeof(char*));
+    const char** suspeitos = (const char**)malloc(quantidade * sizeof(char*));
+    if (textos == NULL || pistas == NULL || embaralhadas == NULL || suspeitos == NULL) {
+        printf("Erro de alocação de memória!\n");
+        exit(1);
+    }
+    const char* nomes[] = {"João", "Maria", "Dr. Silva", "Carlos", "Ana", "Pedro"};
+    for (int i = 0; i < quantidade; i++) {
+        snprintf(textos[i], sizeof(textos[i]), "Pista arquivada %07d", i);
+        pistas[i] = textos[i];
+        embaralhadas[i] = textos[i];
+        suspeitos[i] = nomes[i % 6];
+    }
+    srand(2024);
+    for (int i = quantidade - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        const char* temp = embaralhadas[i];
+        embaralhadas[i] = embaralhadas[j];
+        embaralhadas[j] = temp;
+    }
+    
+    // Caderno: inserções individuais (ordem embaralhada) x montagem balanceada
+    clock_t inicio = clock();
+    Pista* individual = NULL;
+    for (int i = 0; i < quantidade; i++) {
+        individual = inserirPista(individual, embaralhadas[i]);
+    }
+    double tempoIndividual = milissegundosDesde(inicio);
+    
+    inicio = clock();
+    Pista* balanceado = construirCadernoBalanceado(pistas, quantidade);
+    double tempoLote = milissegundosDesde(inicio);
+    
+    printf("\n📓 Caderno de pistas:\n");
+    printf("  inserirPista repetido:      %8.2f ms (altura %d)\n",
+           tempoIndividual, alturaArvorePistas(individual));
+    printf("  construirCadernoBalanceado: %8.2f ms (altura %d)\n",
+           tempoLote, alturaArvorePistas(balanceado));
+    
+    // Tabela hash: inserirNaHash repetido x carga em lote, ambos sobre uma tabela
+    // do mesmo tamanho (a individual é pré-dimensionada para não medir o crescimento).
+    // As confirmações impressas por inserirNaHash são descartadas em /dev/null;
+    // se o redirecionamento falhar, mede-se com a impressão mesmo.
+    inicializarTabelaHash();
+    redimensionarTabelaHash(quantidade > TAMANHO_HASH ? quantidade : TAMANHO_HASH);
+    int tamanhoIndividual = tamanhoHash;
+    fflush(stdout);
+    int saidaOriginal = dup(STDOUT_FILENO);
+    int saidaNula = (saidaOriginal >= 0) ? open("/dev/null", O_WRONLY) : -1;
+    int redirecionada = (saidaNula >= 0 && dup2(saidaNula, STDOUT_FILENO) >= 0);
+    if (!redirecionada) {
+        printf("⚠️  Não foi possível descartar as confirmações: o tempo de inserirNaHash inclui a impressão.\n");
+    }
+    inicio = clock();
+    for (int i = 0; i < quantidade; i++) {
+        inserirNaHash(embaralhadas[i], suspeitos[i]);
+    }
+    fflush(stdout);
+    double tempoInsercaoIndividual = milissegundosDesde(inicio);
+    if (redirecionada) {
+        dup2(saidaOriginal, STDOUT_FILENO);
+    }
+    if (saidaNula >= 0) {
+        close(saidaNula);
+    }
+    if (saidaOriginal >= 0) {
+        close(saidaOriginal);
+    }
+    inicio = clock();
+    for (int i = 0; i < quantidade; i++) {
+        buscarSuspeito(embaralhadas[i]);
+    }
+    double tempoBuscaIndividual = milissegundosDesde(inicio);
+    
+    inicializarTabelaHash();
+    inicio = clock();
+    carregarAssociacoesEmLote(embaralhadas, suspeitos, quantidade);
+    double tempoInsercaoLote = milissegundosDesde(inicio);
+    inicio = clock();
+    for (int i = 0; i < quantidade; i++) {
+        buscarSuspeito(embaralhadas[i]);
+    }
+    double tempoBuscaLote = milissegundosDesde(inicio);
+    
+    printf("\n🗂️  Tabela hash:\n");
+    printf("  inserirNaHash repetido (%d posições):    %8.2f ms | %d buscas: %8.2f ms\n",
+           tamanhoIndividual, tempoInsercaoIndividual, quantidade, tempoBuscaIndividual);
+    printf("  carregarAssociacoesEmLote (%d posições): %8.2f ms | %d buscas: %8.2f ms\n",
+           tamanhoHash, tempoInsercaoLote, quantidade, tempoBuscaLote);
+
+    printf("==================================================\n");
+    
+    // Em um programa real, seria necessário implementar funções
+    // para liberar a memória das estruturas do benchmark
+}
+
+// Gerador pseudoaleatório (xorshift32) do replay: determinístico e barato,
+// para que a medição reflita o jogo e não a função rand()
+unsigned int proximoAleatorio(unsigned int* estado) {
+    unsigned int x = *estado;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *estado = x;
+    return x;
+}
+
+// Função para reproduzir uma exploração roteirizada em uma mansão sintética.
+// Serve de carga representativa (ex.: treino da otimização guiada por perfil)
+// e mede a vazão de navegação, buscas na hash e operações do caderno.
+void executarReplay(int quantidadeSalas) {
+    const char* objetos[] = {"Pegadas", "Cinzas", "Bilhete", "Mancha", "Chave",
+                             "Retrato", "Frasco", "Lâmina", "Poção", "Álibi"};
+    const char* nomes[] = {"João", "Maria", "Dr. Silva", "Carlos", "Ana", "Pedro", "Sônia", "Otávio"};
+    
+    printf("🏃 === REPLAY: MANSÃO SINTÉTICA (%d salas) ===\n", quantidadeSalas);
+    
+    // Montar a mansão como árvore completa; 3 de cada 4 salas têm pista
+    Sala** salas = (Sala**)malloc(quantidadeSalas * sizeof(Sala*));
+    const char** pistas = (const char**)malloc(quantidadeSalas * sizeof(char*));
+    const char** suspeitos = (const char**)malloc(quantidadeSalas * sizeof(char*));
+    if (salas == NULL || pistas == NULL || suspeitos == NULL) {
+        printf("Erro de alocação de memória!\n");
+        exit(1);
+    }
+    int quantidadePistas = 0;
+    for (int i = 0; i < quantidadeSalas; i++) {
+        char nome[TAMANHO_NOME];
+        char pista[TAMANHO_PISTA] = "";
+        snprintf(nome, sizeof(nome), "Sala %07d", i);
+        if (i % 4 != 0) {
+            snprintf(pista, sizeof(pista), "%s %07d", objetos[i % 10], i);
+        }
+        salas[i] = criarSala(nome, pista);
+        if (i % 4 != 0) {
+            pistas[quantidadePistas] = salas[i]->pista;
+            suspeitos[quantidadePistas] = nomes[(i / 3) % 8];
+            quantidadePistas++;
+        }
+    }
+    for (int i = 0; i < quantidadeSalas; i++) {
+        salas[i]->esquerda = (2 * i + 1 < quantidadeSalas) ? salas[2 * i + 1] : NULL;
+        salas[i]->direita = (2 * i + 2 < quantidadeSalas) ? salas[2 * i + 2] : NULL;
+    }
+    
+    inicializarTabelaHash();
+    carregarAssociacoesEmLote(pistas, suspeitos, quantidadePistas);
+    configurarDecaimento(64);
+    for (int i = 1; i < quantidadeSalas; i += 7) {
+        salas[i]->peso = PESO_NORMAL * 3 / 2;
+    }
+    
+    unsigned long verificacao = 0;
+    unsigned int estado = 31;
+    
+    // Navegação: caminhadas aleatórias da entrada até uma folha
+    long movimentos = 0;
+    clock_t inicio = clock();
+    for (int caminhada = 0; caminhada < quantidadeSalas; caminhada++) {
+        Sala* atual = salas[0];
+        while (atual->esquerda != NULL || atual->direita != NULL) {
+            Sala* proxima = (proximoAleatorio(&estado) & 1) ? atual->esquerda : atual->direita;
+            atual = (proxima != NULL) ? proxima : (atual->esquerda != NULL ? atual->esquerda : atual->direita);
+            movimentos++;
+        }
+        verificacao += (unsigned char)atual->nome[strlen(atual->nome) - 1];
+    }
+    double tempoNavegacao = milissegundosDesde(inicio);
+    
+    // Hash: consultas de suspeito por pista
+    int buscas = (quantidadePistas > 0) ? 5 * quantidadeSalas : 0;
+    inicio = clock();
+    for (int i = 0; i < buscas; i++) {
+        verificacao += (unsigned char)buscarSuspeito(pistas[proximoAleatorio(&estado) % quantidadePistas])[0];
+    }
+    double tempoHash = milissegundosDesde(inicio);
+    
+    // Caderno: caminhadas coletando pistas, com uma página do caderno formatada periodicamente
+    Pista* arvorePistas = NULL;
+    long visitas = 0;
+    int coletadas = 0;
+    inicio = clock();
+    for (int caminhada = 0; caminhada < quantidadeSalas / 4; caminhada++) {
+        Sala* atual = salas[0];
+        for (;;) {
+            coletadas += coletarPistaDaSala(atual, &arvorePistas);
+            visitas++;
+            if (atual->esquerda == NULL && atual->direita == NULL) {
+                break;
+            }
+            Sala* proxima = (proximoAleatorio(&estado) & 1) ? atual->esquerda : atual->direita;
+            atual = (proxima != NULL) ? proxima : (atual->esquerda != NULL ? atual->esquerda : atual->direita);
+            movimentosExploracao++;
+        }
+        if (caminhada % 4096 == 4095) {
+            int meio = contarPistas(arvorePistas) / 2;
+            verificacao += (unsigned long)obterVisaoCaderno(arvorePistas, meio, LINHAS_POR_PAGINA)->totalLinhas;
+        }
+    }
+    double tempoCaderno = milissegundosDesde(inicio);
+    
+    // Evitar divisão por zero em execuções muito curtas
+    if (tempoNavegacao <= 0) tempoNavegacao = 0.001;
+    if (tempoHash <= 0) tempoHash = 0.001;
+    if (tempoCaderno <= 0) tempoCaderno = 0.001;
+    
+    printf("  navegação %14.0f ops/s (%ld movimentos)\n", movimentos / (tempoNavegacao / 1000.0), movimentos);
+    printf("  hash      %14.0f ops/s (%d buscas)\n", buscas / (tempoHash / 1000.0), buscas);
+    printf("  caderno   %14.0f ops/s (%ld visitas, %d pistas coletadas)\n",
+           visitas / (tempoCaderno / 1000.0), visitas, coletadas);
+    printf("  verificação: %lu\n", verificacao);
+    printf("==================================================\n");
+    
+    // Em um programa real, seria necessário implementar funções
+    // para liberar a memória da mansão sintética
+}
+
 // Função principal
-int main() {
+int main(int argc, char* argv[]) {
+    // Opções de linha de comando (lidas antes de qualquer pista entrar no caderno):
+    //   --colacao-binaria     ordena o caderno pelos bytes (strcmp) e não em português
+    //   --bench [quantidade]  modo de medição
+    //   --replay [salas]      carga roteirizada em uma mansão sintética
+    int modoBenchmark = 0;
+    int modoReplay = 0;
+    int quantidade = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--colacao-binaria") == 0) {
+            modoColacao = COLACAO_BINARIA;
+        } else if (strcmp(argv[i], "--bench") == 0 || strcmp(argv[i], "--replay") == 0) {
+            modoBenchmark = (argv[i][2] == 'b');
+            modoReplay = !modoBenchmark;
+            if (i + 1 < argc && isdigit((unsigned char)argv[i + 1][0])) {
+                quantidade = atoi(argv[++i]);
+            }
+        } else {
+            printf("Opção desconhecida: %s\n", argv[i]);
+            printf("Uso: %s [--colacao-binaria] [--bench [quantidade] | --replay [salas]]\n", argv[0]);
+            return 1;
+        }
+    }
+    
+    if (modoBenchmark) {
+        executarBenchmark(quantidade > 0 ? quantidade : TAMANHO_BENCHMARK);
+        return 0;
+    }
+    if (modoReplay) {
+        executarReplay(quantidade > 0 ? quantidade : TAMANHO_REPLAY);
+        return 0;
+    }
+    
     // Inicializar tabela hash
     inicializarTabelaHash();
     
     // Configurar associações pista → suspeito
     inicializarAssociacoes();
     
+    // Pesos das pistas e decaimento das evidências mais antigas
+    definirPesoPista("Faca desaparecida do bloco", PESO_NORMAL * 2);
+    definirPesoPista("Livro sobre venenos aberto", PESO_NORMAL * 3 / 2);
+    definirPesoPista("Cadeira desarrumada", PESO_NORMAL / 2);
+    configurarDecaimento(MEIA_VIDA_PADRAO);
+    
     // Construção da árvore binária representando o mapa da mansão
     Sala* hallEntrada = criarSala("Hall de Entrada", "Porta principal arrombada");
     Sala* salaEstar = criarSala("Sala de Estar", "Copo de vinho meio cheio");
@@ -372,6 +1391,12 @@ int main() {
     Sala* despensa = criarSala("Despensa", "Cheiro estranho");
     Sala* varanda = criarSala("Varanda", "Cinzas de cigarro raro");
     
+    // Pesos das salas: cinzas na Varanda (onde se fuma) dizem menos que no Hall
+    hallEntrada->peso = PESO_NORMAL * 3 / 2;
+    escritorio->peso = PESO_NORMAL * 3 / 2;
+    varanda->peso = PESO_NORMAL / 2;
+    jardimInverno->peso = PESO_NORMAL / 2;
+    
     // Montagem da árvore
     hallEntrada->esquerda = salaEstar;
     hallEntrada->direita = corredorPrincipal;
@@ -396,14 +1421,34 @@ int main() {
     
     if (arvorePistas != NULL) {
         printf("\nTodas as pistas e suspeitos associados:\n");
-        exibirPistasEmOrdem(arvorePistas);
+        VisaoRenderizada* caderno = obterVisaoCaderno(arvorePistas, 0, contarPistas(arvorePistas));
+        exibirLinhasVisao(caderno, 0, caderno->totalLinhas);
     }
     
     printf("\n📊 Análise final dos suspeitos:\n");
-    exibirAssociacoesPistasSuspeitos();
-    encontrarSuspeitoMaisCitado();
+    printf("\n📋 === ASSOCIAÇÕES PISTA → SUSPEITO ===\n");
+    VisaoRenderizada* associacoes = obterVisaoAssociacoes();
+    if (associacoes->totalLinhas == 0) {
+        printf("Nenhuma associação registrada.\n");
+    } else {
+        exibirLinhasVisao(associacoes, 0, associacoes->totalLinhas);
+        printf("Total de associações: %d\n", associacoes->totalLinhas);
+    }
+    printf("=====================================\n");
+    FichaSuspeito* maisCitado = encontrarSuspeitoMaisCitado();
+    FichaSuspeito* primeiroRanking = exibirRankingPonderado();
     
-    printf("\n💡 Baseado nas evidências, o suspeito mais citado é o principal candidato a culpado!\n");
+    if (primeiroRanking == NULL) {
+        printf("\n💡 Sem evidências coletadas, não há como apontar um culpado.\n");
+    } else if (maisCitado == NULL || maisCitado->pistasColetadas == primeiroRanking->pistasColetadas) {
+        // Empatar com o mais citado também é liderar a contagem bruta
+        printf("\n💡 Baseado nas evidências, %s lidera o ranking ponderado e tem o maior número de pistas coletadas: é o principal candidato a culpado!\n",
+               primeiroRanking->nome);
+    } else {
+        printf("\n💡 Baseado nas evidências ponderadas, %s é o principal candidato a culpado,\n"
+               "   embora %s seja o mais citado na contagem bruta de pistas.\n",
+               primeiroRanking->nome, maisCitado->nome);
+    }
     printf("==================================================\n");
     
     return 0;